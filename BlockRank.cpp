@@ -0,0 +1,197 @@
+#include "BlockRank.hpp"
+#include "PageRank.hpp"
+#include "constants.hpp"
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Runs the BlockRank variant of page rank. Pages are grouped into blocks (e.g. hosts or domains) using
+ * the labels in blocks.txt, a local page rank is computed within every block in parallel, then a block
+ * level rank is computed from the aggregated block graph. The product of the two is used as the starting
+ * rank of the global Markov process, and the number of global iterations is printed with the result.
+ * Throws an exception if an input file cannot be opened or is invalid.
+ */
+void runBlockRank() {
+    string connectivity_path("../connectivity.txt");
+    string blocks_path("../blocks.txt");
+    ifstream input_file(connectivity_path);
+    ifstream block_file(blocks_path);
+    if (!input_file.is_open()) {
+        throw runtime_error("Unable to open " + connectivity_path);
+    }
+    if (!block_file.is_open()) {
+        throw runtime_error("Unable to open " + blocks_path);
+    }
+
+    vector<double> values_vector = getConnectivityValuesAsVector(input_file);
+
+    Matrix importance_matrix = generateImportanceMatrix(values_vector.data(), (int) values_vector.size());
+    int    size              = importance_matrix.getNumOfColumns();
+
+    vector<int>         block_labels = getBlockLabelsAsVector(block_file, size);
+    vector<vector<int>> blocks       = groupPagesByBlock(block_labels);
+    vector<double>      local_ranks  = computeLocalRanks(values_vector, size, blocks);
+
+    Matrix block_matrix     = generateBlockMatrix(importance_matrix, block_labels, (int) blocks.size(),
+                                                  local_ranks);
+    Matrix block_transition = generateTransitionMatrix(block_matrix,
+                                                       generateProbabilityTeleportMatrix((int) blocks.size()));
+    Matrix block_rank       = doMarkovProcessToGetFinalMatrix(block_transition);
+
+    Matrix warm_start_matrix = generateWarmStartRankMatrix(block_labels, local_ranks, block_rank);
+    Matrix transition_matrix = generateTransitionMatrix(importance_matrix, generateProbabilityTeleportMatrix(size));
+    int    global_iterations{0};
+    Matrix final_matrix      = rankMatrixStopChanging(transition_matrix, warm_start_matrix, global_iterations);
+    printResult(final_matrix);
+    cout << "Global iterations: " << global_iterations << endl;
+    input_file.close();
+    block_file.close();
+}
+
+/**
+ * Reads blocks.txt file which contains one block label per page, in the same order as the pages
+ * of the connectivity matrix. Labels can be any whitespace-free token such as a host name, they are
+ * renumbered from 0 in order of first appearance. Throws an exception if the number of labels does
+ * not match the number of pages.
+ * @param block_file the input file containing the labels
+ * @param size number of pages
+ * @return int vector that contains the block index of every page
+ */
+vector<int> getBlockLabelsAsVector(ifstream &block_file, int size) {
+    string label;
+    vector<int> block_labels;
+    unordered_map<string, int> block_indices;
+    while (block_file >> label) {
+        auto inserted = block_indices.emplace(label, (int) block_indices.size());
+        block_labels.push_back(inserted.first->second);
+    }
+    if ((int) block_labels.size() != size) {
+        throw invalid_argument("Number of block labels must be the same as the number of pages");
+    }
+    return block_labels;
+}
+
+/**
+ * Groups the pages by their block index.
+ * @param block_labels block index of every page
+ * @return for every block, the pages that belong to it in ascending order
+ */
+vector<vector<int>> groupPagesByBlock(const vector<int> &block_labels) {
+    int number_of_blocks = *max_element(block_labels.begin(), block_labels.end()) + 1;
+    vector<vector<int>> blocks(number_of_blocks);
+    for (int page = 0; page < (int) block_labels.size(); page++) {
+        blocks.at(block_labels.at(page)).push_back(page);
+    }
+    return blocks;
+}
+
+/**
+ * Computes the local page rank of every block, using only the links between pages of the same block.
+ * Every block is small enough to be solved as its own dense matrix, and the blocks are shared out
+ * between worker threads.
+ * @param values connectivity values of the whole web, row by row
+ * @param size number of pages
+ * @param blocks the pages of every block
+ * @return local rank of every page, the ranks within a block sum to 1
+ */
+vector<double> computeLocalRanks(const vector<double> &values, int size, const vector<vector<int>> &blocks) {
+    vector<double> local_ranks(size, 0.0);
+    atomic<int>    next_block{0};
+
+    auto worker = [&]() {
+        for (int b = next_block++; b < (int) blocks.size(); b = next_block++) {
+            const vector<int> &pages = blocks.at(b);
+            vector<double> block_values;
+            block_values.reserve(pages.size() * pages.size());
+            for (int r: pages) {
+                for (int c: pages) {
+                    block_values.push_back(values.at(r * size + c));
+                }
+            }
+
+            Matrix importance_matrix = generateImportanceMatrix(block_values.data(), (int) block_values.size());
+            Matrix transition_matrix = generateTransitionMatrix(importance_matrix,
+                                                                generateProbabilityTeleportMatrix((int) pages.size()));
+            Matrix local_rank        = doMarkovProcessToGetFinalMatrix(transition_matrix);
+
+            double sum{0.0};
+            for (int r = 0; r < local_rank.getNumOfRows(); r++) {
+                sum += local_rank.getValue(r, 0);
+            }
+            for (int r = 0; r < local_rank.getNumOfRows(); r++) {
+                local_ranks.at(pages.at(r)) = local_rank.getValue(r, 0) / sum;
+            }
+        }
+    };
+
+    int number_of_workers = min((int) blocks.size(), max(1, (int) thread::hardware_concurrency()));
+    vector<future<void>> workers;
+    for (int w = 0; w < number_of_workers; w++) {
+        workers.push_back(async(launch::async, worker));
+    }
+    for (future<void> &w: workers) {
+        w.get();
+    }
+    return local_ranks;
+}
+
+/**
+ * Aggregates the importance matrix into a block matrix. The link from block J to block I is weighted
+ * by the local rank of the pages of block J, so every column of the block matrix still sums to 1.
+ * @param importance_matrix the importance matrix of the whole web
+ * @param block_labels block index of every page
+ * @param number_of_blocks number of blocks
+ * @param local_ranks local rank of every page
+ * @return block importance matrix
+ */
+Matrix generateBlockMatrix(const Matrix &importance_matrix, const vector<int> &block_labels, int number_of_blocks,
+                           const vector<double> &local_ranks) {
+    vector<vector<double>> importance = importance_matrix.getMatrix();
+    vector<vector<double>> block_values(number_of_blocks, vector<double>(number_of_blocks, 0.0));
+    for (int r = 0; r < importance_matrix.getNumOfRows(); r++) {
+        vector<double> &block_row = block_values[block_labels[r]];
+        for (int c = 0; c < importance_matrix.getNumOfColumns(); c++) {
+            block_row[block_labels[c]] += importance[r][c] * local_ranks[c];
+        }
+    }
+
+    Matrix block_matrix(number_of_blocks);
+    for (int r = 0; r < number_of_blocks; r++) {
+        for (int c = 0; c < number_of_blocks; c++) {
+            block_matrix.setValue(r, c, block_values[r][c]);
+        }
+    }
+    return block_matrix;
+}
+
+/**
+ * Creates the starting rank matrix for the global Markov process from the product of the block rank
+ * and the local rank of every page. It is scaled to the same total as the default rank matrix of 1s.
+ * @param block_labels block index of every page
+ * @param local_ranks local rank of every page
+ * @param block_rank rank matrix of the block matrix
+ * @return rank matrix
+ */
+Matrix generateWarmStartRankMatrix(const vector<int> &block_labels, const vector<double> &local_ranks,
+                                   Matrix block_rank) {
+    double block_sum{0.0};
+    for (int r = 0; r < block_rank.getNumOfRows(); r++) {
+        block_sum += block_rank.getValue(r, 0);
+    }
+
+    int size = (int) block_labels.size();
+    Matrix rank_matrix(size, NUMBER_OF_COLUMN_FOR_DEFAULT_RANK_MATRIX);
+    for (int r = 0; r < size; r++) {
+        rank_matrix.setValue(r, 0, size * local_ranks.at(r) * block_rank.getValue(block_labels.at(r), 0) / block_sum);
+    }
+    return rank_matrix;
+}
@@ -0,0 +1,20 @@
+#ifndef LAB1TEMPLATE_BLOCKRANK_HPP
+#define LAB1TEMPLATE_BLOCKRANK_HPP
+
+#include <vector>
+#include <fstream>
+#include "matrix.hpp"
+
+void runBlockRank();
+
+std::vector<int> getBlockLabelsAsVector(std::ifstream &, int);
+
+std::vector<std::vector<int>> groupPagesByBlock(const std::vector<int> &);
+
+std::vector<double> computeLocalRanks(const std::vector<double> &, int, const std::vector<std::vector<int>> &);
+
+Matrix generateBlockMatrix(const Matrix &, const std::vector<int> &, int, const std::vector<double> &);
+
+Matrix generateWarmStartRankMatrix(const std::vector<int> &, const std::vector<double> &, Matrix);
+
+#endif //LAB1TEMPLATE_BLOCKRANK_HPP
@@ -1,12 +1,11 @@
 #include "PageRank.hpp"
+#include "constants.hpp"
 #include <exception>
 #include <iostream>
 #include <vector>
 
 #define FOLLOW_PROBABILITY 0.85
 #define NOT_FOLLOW_PROBABILITY 0.15
-#define RANK_MATRIX_DEFAULT_VALUE 1.0
-#define NUMBER_OF_COLUMN_FOR_DEFAULT_RANK_MATRIX 1
 
 using namespace std;
 
@@ -140,13 +139,28 @@ Matrix doMarkovProcessToGetFinalMatrix(Matrix transition_matrix) {
  * @return final matrix that contains the page ranks
  */
 Matrix rankMatrixStopChanging(Matrix transition_matrix, Matrix rank_matrix) {
+    int iterations{0};
+    return rankMatrixStopChanging(transition_matrix, rank_matrix, iterations);
+}
+
+/**
+ * Same as rankMatrixStopChanging, and also reports how many times the rank matrix was multiplied
+ * by the transition matrix before it stopped changing.
+ * @param transition_matrix transition matrix
+ * @param rank_matrix rank matrix
+ * @param iterations set to the number of multiplications performed
+ * @return final matrix that contains the page ranks
+ */
+Matrix rankMatrixStopChanging(Matrix transition_matrix, Matrix rank_matrix, int &iterations) {
     Matrix temp(rank_matrix.getNumOfRows(), NUMBER_OF_COLUMN_FOR_DEFAULT_RANK_MATRIX);
 
     Matrix new_rank_matrix = newRankMatrix(transition_matrix, rank_matrix);
+    iterations = 1;
     while (new_rank_matrix != rank_matrix) {
         rank_matrix = new_rank_matrix;
         Matrix temp = newRankMatrix(transition_matrix, rank_matrix);
         new_rank_matrix = temp;
+        iterations++;
     }
     return rank_matrix;
 }
@@ -173,7 +187,7 @@ void printResult(Matrix final_matrix) {
         sum += final_matrix.getValue(r, 0);
     }
 
-    for (int r; r < final_matrix.getNumOfRows(); r++) {
+    for (int r = 0; r < final_matrix.getNumOfRows(); r++) {
         final_matrix.setValue(r, 0, final_matrix.getValue(r, 0) / sum);
         cout << "Page " << page++ << ": " << final_matrix.getValue(r, 0) * 100 << "%" << endl;
     }
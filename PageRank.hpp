@@ -21,6 +21,8 @@ Matrix doMarkovProcessToGetFinalMatrix(Matrix);
 
 Matrix rankMatrixStopChanging(Matrix, Matrix);
 
+Matrix rankMatrixStopChanging(Matrix, Matrix, int &);
+
 Matrix newRankMatrix(Matrix, Matrix);
 
 void printResult(Matrix);
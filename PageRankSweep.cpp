@@ -0,0 +1,245 @@
+#include "PageRankSweep.hpp"
+#include "PageRank.hpp"
+#include "constants.hpp"
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Runs page rank for every configuration listed in sweep.txt at once. Each configuration has its own
+ * follow probability and teleport set, and gets its own column in the rank matrix. The results are
+ * written to sweep_result.txt, one column per configuration. Throws an exception if a file cannot be
+ * opened or sweep.txt is invalid.
+ */
+void runPageRankSweep() {
+    string connectivity_path("../connectivity.txt");
+    string sweep_path("../sweep.txt");
+    string result_path("../sweep_result.txt");
+    ifstream input_file(connectivity_path);
+    ifstream sweep_file(sweep_path);
+    if (!input_file.is_open()) {
+        throw runtime_error("Unable to open " + connectivity_path);
+    }
+    if (!sweep_file.is_open()) {
+        throw runtime_error("Unable to open " + sweep_path);
+    }
+
+    vector<double> values_vector = getConnectivityValuesAsVector(input_file);
+
+    Matrix importance_matrix = generateImportanceMatrix(values_vector.data(), (int) values_vector.size());
+    vector<SweepConfiguration> configurations = getSweepConfigurationsAsVector(sweep_file,
+                                                                               importance_matrix.getNumOfColumns());
+    Matrix final_matrix = doSweepMarkovProcess(importance_matrix, configurations);
+
+    ofstream result_file(result_path);
+    if (!result_file.is_open()) {
+        throw runtime_error("Unable to open " + result_path);
+    }
+    writeSweepResult(result_file, final_matrix, configurations);
+    input_file.close();
+    sweep_file.close();
+    result_file.close();
+}
+
+/**
+ * Reads sweep.txt file, every line is one configuration: the follow probability followed by the indices
+ * of the pages in the teleport set, starting at 0. A page can be written as page:weight to give it a
+ * weight other than 1, e.g. to decay older pages. A line with no pages teleports uniformly to every page
+ * and blank lines are skipped. Throws an exception if a value is not a number or is out of range.
+ * @param sweep_file the input file containing the configurations
+ * @param size number of pages
+ * @return vector that contains all the configurations in order
+ */
+vector<SweepConfiguration> getSweepConfigurationsAsVector(ifstream &sweep_file, int size) {
+    vector<SweepConfiguration> configurations;
+    string line;
+    int line_number{0};
+    while (getline(sweep_file, line)) {
+        line_number++;
+        if (line.find_first_not_of(" \t\r") == string::npos) {
+            continue;
+        }
+
+        istringstream line_stream(line);
+        SweepConfiguration configuration{};
+        if (!(line_stream >> configuration.follow_probability)) {
+            throw invalid_argument("sweep.txt line " + to_string(line_number) + ": follow probability is not a number");
+        }
+        if (configuration.follow_probability < 0 || configuration.follow_probability >= 1) {
+            throw invalid_argument("sweep.txt line " + to_string(line_number)
+                                   + ": follow probability must be at least 0 and less than 1");
+        }
+
+        string token;
+        while (line_stream >> token) {
+            size_t separator = token.find(':');
+            istringstream page_stream(token.substr(0, separator));
+            int page{0};
+            if (!(page_stream >> page) || !page_stream.eof()) {
+                throw invalid_argument("sweep.txt line " + to_string(line_number) + ": teleport page is not an integer");
+            }
+            if (page < 0 || page >= size) {
+                throw invalid_argument("sweep.txt line " + to_string(line_number)
+                                       + ": teleport page must be in range of the number of pages");
+            }
+
+            double weight{1.0};
+            if (separator != string::npos) {
+                istringstream weight_stream(token.substr(separator + 1));
+                if (!(weight_stream >> weight) || !weight_stream.eof() || !isfinite(weight) || weight <= 0) {
+                    throw invalid_argument("sweep.txt line " + to_string(line_number)
+                                           + ": teleport weight must be a positive number");
+                }
+            }
+            configuration.teleport_pages.push_back(page);
+            configuration.teleport_weights.push_back(weight);
+        }
+        configurations.push_back(configuration);
+    }
+    if (configurations.empty()) {
+        throw invalid_argument("Sweep needs at least one configuration");
+    }
+    return configurations;
+}
+
+/**
+ * Performs the Markov process for all configurations together. Every iteration walks the importance
+ * matrix once and updates the rank of every configuration that has not converged yet, so the cost of
+ * reading the matrix is shared between them. A configuration stops being updated once its rank stops
+ * changing.
+ * @param importance_matrix the importance matrix
+ * @param configurations follow probability and teleport set of every configuration
+ * @return rank matrix with one column per configuration
+ */
+Matrix doSweepMarkovProcess(const Matrix &importance_matrix, const vector<SweepConfiguration> &configurations) {
+    vector<vector<double>> importance = importance_matrix.getMatrix();
+    int size              = importance_matrix.getNumOfColumns();
+    int number_of_configs = (int) configurations.size();
+
+    // teleport[r][k] is the probability of teleporting to page r in configuration k.
+    vector<vector<double>> teleport(size, vector<double>(number_of_configs, 0.0));
+    for (int k = 0; k < number_of_configs; k++) {
+        const vector<int>    &pages   = configurations.at(k).teleport_pages;
+        const vector<double> &weights = configurations.at(k).teleport_weights;
+        if (pages.empty()) {
+            for (int r = 0; r < size; r++) {
+                teleport.at(r).at(k) = 1 / (double) size;
+            }
+        } else {
+            // Weights are scaled to sum to 1, a page listed twice gets the sum of its weights.
+            double sum_of_weights{0.0};
+            for (double weight: weights) {
+                sum_of_weights += weight;
+            }
+            for (size_t i = 0; i < pages.size(); i++) {
+                teleport.at(pages.at(i)).at(k) += weights.at(i) / sum_of_weights;
+            }
+        }
+    }
+
+    vector<vector<double>> rank(size, vector<double>(number_of_configs, RANK_MATRIX_DEFAULT_VALUE));
+    vector<vector<double>> new_rank(size, vector<double>(number_of_configs, 0.0));
+    vector<int> active;
+    for (int k = 0; k < number_of_configs; k++) {
+        active.push_back(k);
+    }
+
+    while (!active.empty()) {
+        vector<double> sum_of_columns(number_of_configs, 0.0);
+        for (int r = 0; r < size; r++) {
+            for (int k: active) {
+                sum_of_columns.at(k) += rank.at(r).at(k);
+                new_rank.at(r).at(k) = 0.0;
+            }
+        }
+
+        for (int r = 0; r < size; r++) {
+            for (int c = 0; c < size; c++) {
+                double value = importance.at(r).at(c);
+                if (value == 0) {
+                    continue;
+                }
+                for (int k: active) {
+                    new_rank.at(r).at(k) += value * rank.at(c).at(k);
+                }
+            }
+            for (int k: active) {
+                double follow_probability = configurations.at(k).follow_probability;
+                new_rank.at(r).at(k) = follow_probability * new_rank.at(r).at(k)
+                                       + (1 - follow_probability) * teleport.at(r).at(k) * sum_of_columns.at(k);
+            }
+        }
+
+        vector<int> still_active;
+        for (int k: active) {
+            bool converged = true;
+            for (int r = 0; r < size; r++) {
+                if (fabs(new_rank.at(r).at(k) - rank.at(r).at(k)) >= TOLERANCE) {
+                    converged = false;
+                }
+                rank.at(r).at(k) = new_rank.at(r).at(k);
+            }
+            if (!converged) {
+                still_active.push_back(k);
+            }
+        }
+        active = still_active;
+    }
+
+    Matrix rank_matrix(size, number_of_configs);
+    for (int r = 0; r < size; r++) {
+        for (int k = 0; k < number_of_configs; k++) {
+            rank_matrix.setValue(r, k, rank.at(r).at(k));
+        }
+    }
+    return rank_matrix;
+}
+
+/**
+ * Writes the page ranks of every configuration as columns, scaled so every column sums to 1.
+ * The header names each column by its follow probability and teleport set.
+ * @param result_file the output file
+ * @param final_matrix rank matrix with one column per configuration
+ * @param configurations follow probability and teleport set of every configuration
+ */
+void writeSweepResult(ofstream &result_file, Matrix final_matrix, const vector<SweepConfiguration> &configurations) {
+    result_file << "page";
+    for (const SweepConfiguration &configuration: configurations) {
+        result_file << "\tp=" << configuration.follow_probability << ":";
+        if (configuration.teleport_pages.empty()) {
+            result_file << "all";
+        }
+        for (size_t i = 0; i < configuration.teleport_pages.size(); i++) {
+            result_file << (i == 0 ? "" : ",") << configuration.teleport_pages.at(i);
+            if (configuration.teleport_weights.at(i) != 1.0) {
+                result_file << ":" << configuration.teleport_weights.at(i);
+            }
+        }
+    }
+    result_file << "\n";
+    result_file << setprecision(numeric_limits<double>::max_digits10);
+
+    for (int c = 0; c < final_matrix.getNumOfColumns(); c++) {
+        double sum{0.0};
+        for (int r = 0; r < final_matrix.getNumOfRows(); r++) {
+            sum += final_matrix.getValue(r, c);
+        }
+        for (int r = 0; r < final_matrix.getNumOfRows(); r++) {
+            final_matrix.setValue(r, c, final_matrix.getValue(r, c) / sum);
+        }
+    }
+
+    for (int r = 0; r < final_matrix.getNumOfRows(); r++) {
+        result_file << r;
+        for (int c = 0; c < final_matrix.getNumOfColumns(); c++) {
+            result_file << "\t" << final_matrix.getValue(r, c);
+        }
+        result_file << "\n";
+    }
+}
@@ -0,0 +1,22 @@
+#ifndef LAB1TEMPLATE_PAGERANKSWEEP_HPP
+#define LAB1TEMPLATE_PAGERANKSWEEP_HPP
+
+#include <vector>
+#include <fstream>
+#include "matrix.hpp"
+
+struct SweepConfiguration {
+    double follow_probability;
+    std::vector<int> teleport_pages;
+    std::vector<double> teleport_weights;
+};
+
+void runPageRankSweep();
+
+std::vector<SweepConfiguration> getSweepConfigurationsAsVector(std::ifstream &, int);
+
+Matrix doSweepMarkovProcess(const Matrix &, const std::vector<SweepConfiguration> &);
+
+void writeSweepResult(std::ofstream &, Matrix, const std::vector<SweepConfiguration> &);
+
+#endif //LAB1TEMPLATE_PAGERANKSWEEP_HPP
@@ -0,0 +1,8 @@
+#ifndef LAB1TEMPLATE_CONSTANTS_HPP
+#define LAB1TEMPLATE_CONSTANTS_HPP
+
+#define TOLERANCE 0.000000001
+#define RANK_MATRIX_DEFAULT_VALUE 1.0
+#define NUMBER_OF_COLUMN_FOR_DEFAULT_RANK_MATRIX 1
+
+#endif //LAB1TEMPLATE_CONSTANTS_HPP
@@ -1,8 +1,35 @@
 #include "PageRank.hpp"
+#include "BlockRank.hpp"
+#include "PageRankSweep.hpp"
+#include <exception>
+#include <iostream>
+#include <string>
 
 using namespace std;
 
-int main() {
-    runPageRank();
+int main(int argc, char *argv[]) {
+    string mode = argc > 1 ? string(argv[1]) : string();
+    if (argc > 2 || (argc > 1 && mode != "--blockrank" && mode != "--sweep")) {
+        cerr << "Usage: " << argv[0] << " [--blockrank | --sweep]" << endl;
+        return 1;
+    }
+
+    try {
+        if (mode == "--blockrank") {
+            runBlockRank();
+        } else if (mode == "--sweep") {
+            runPageRankSweep();
+        } else {
+            runPageRank();
+        }
+    }
+    catch (exception &e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    catch (const char *message) {
+        cerr << message << endl;
+        return 1;
+    }
     return 0;
 }
@@ -1,10 +1,9 @@
 #include "matrix.hpp"
+#include "constants.hpp"
 #include <vector>
 #include <iostream>
 #include <cmath>
 
-#define TOLERANCE 0.000000001
-
 using namespace std;
 
 /**